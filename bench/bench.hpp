@@ -0,0 +1,134 @@
+// bench.hpp
+#pragma once
+
+#include <algorithm>    // std::sort
+#include <chrono>       // std::chrono::steady_clock
+#include <cmath>        // std::sqrt
+#include <cstdint>      // std::uint64_t
+#include <cstdio>       // std::fprintf
+#include <string>       // std::string
+#include <utility>      // std::move
+#include <vector>       // std::vector
+
+// Minimal benchmark harness: calibrate a batch size, warm up, then time
+// `reps` batches and report per-operation statistics in nanoseconds.
+namespace bench {
+
+// Keep the optimizer from discarding a computed value.
+template <typename T>
+inline void keep(T const& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile T sink;
+    sink = value;
+#endif
+}
+
+struct Config
+{
+    int         warmup   = 3;     // untimed batches after calibration
+    int         reps     = 200;   // timed batches; p99 is only distinct from max at >= 100
+    double      batch_us = 500.0; // calibration target per batch
+    std::string filter;           // run only names containing this
+};
+
+struct Result
+{
+    std::string   name;
+    std::uint64_t iters = 0; // operations per batch
+    int           reps  = 0;
+    double min = 0, p50 = 0, p90 = 0, p99 = 0, max = 0, mean = 0, stddev = 0; // ns/op
+};
+
+class Runner
+{
+public:
+    explicit Runner(Config config) : config_(std::move(config)) {}
+
+    // `op` performs one operation; it is called `iters` times per batch.
+    template <typename F>
+    void run(const std::string& name, F&& op)
+    {
+        if (!config_.filter.empty() && name.find(config_.filter) == std::string::npos) return;
+
+        std::uint64_t iters = 1;
+        while (batch(op, iters) < config_.batch_us * 1000.0 && iters < (1ull << 30)) iters *= 2;
+        for (int i = 0; i < config_.warmup; ++i) batch(op, iters);
+
+        std::vector<double> samples(config_.reps);
+        for (auto& s : samples) s = batch(op, iters) / (double)iters;
+
+        results_.push_back(summarize(name, iters, samples));
+        report(results_.back());
+    }
+
+    const std::vector<Result>& results() const { return results_; }
+
+    static std::string json(const Result& r)
+    {
+        char buf[512];
+        std::snprintf(buf, sizeof(buf),
+            "{\"name\":\"%s\",\"unit\":\"ns/op\",\"iters\":%llu,\"reps\":%d,"
+            "\"min\":%.3f,\"p50\":%.3f,\"p90\":%.3f,\"p99\":%.3f,\"max\":%.3f,"
+            "\"mean\":%.3f,\"stddev\":%.3f}",
+            r.name.c_str(), (unsigned long long)r.iters, r.reps,
+            r.min, r.p50, r.p90, r.p99, r.max, r.mean, r.stddev);
+        return buf;
+    }
+
+private:
+    Config config_;
+    std::vector<Result> results_;
+
+    template <typename F>
+    static double batch(F& op, std::uint64_t iters)
+    {
+        const auto t0 = std::chrono::steady_clock::now();
+        for (std::uint64_t i = 0; i < iters; ++i) op();
+        const auto t1 = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(t1 - t0).count();
+    }
+
+    // nearest-rank percentile over sorted samples; with n samples, p only
+    // resolves below max when ceil(p/100 * n) < n (p99 needs n >= 100)
+    static double percentile(const std::vector<double>& sorted, double p)
+    {
+        const std::size_t rank = (std::size_t)std::ceil(p / 100.0 * (double)sorted.size());
+        return sorted[std::min(sorted.size() - 1, rank > 0 ? rank - 1 : 0)];
+    }
+
+    static Result summarize(const std::string& name, std::uint64_t iters, std::vector<double> samples)
+    {
+        std::sort(samples.begin(), samples.end());
+
+        double sum = 0.0;
+        for (double s : samples) sum += s;
+        const double mean = sum / (double)samples.size();
+
+        double var = 0.0;
+        for (double s : samples) var += (s - mean) * (s - mean);
+
+        Result r;
+        r.name   = name;
+        r.iters  = iters;
+        r.reps   = (int)samples.size();
+        r.min    = samples.front();
+        r.p50    = percentile(samples, 50.0);
+        r.p90    = percentile(samples, 90.0);
+        r.p99    = percentile(samples, 99.0);
+        r.max    = samples.back();
+        r.mean   = mean;
+        r.stddev = samples.size() > 1 ? std::sqrt(var / (double)(samples.size() - 1)) : 0.0;
+        return r;
+    }
+
+    static void report(const Result& r)
+    {
+        std::fprintf(stderr, "%-36s p50 %12.2f  p90 %12.2f  p99 %12.2f ns/op  (x%llu, %d reps)\n",
+                     r.name.c_str(), r.p50, r.p90, r.p99, (unsigned long long)r.iters, r.reps);
+    }
+};
+
+} // namespace bench
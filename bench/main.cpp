@@ -0,0 +1,267 @@
+// Headless benchmarks for engine hot paths: `make bench`.
+//
+// Human-readable lines go to stderr; one JSON object per benchmark goes to
+// stdout (or --out FILE). Pass --baseline FILE to compare p50s against an
+// earlier run; the exit code is 1 if anything got slower than --tolerance %
+// or a baseline benchmark did not run. Keep --reps >= 100 (default 200) so
+// p99 is not simply the slowest sample.
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+#include "../src/engine/map.hpp"
+#include "../src/engine/window.hpp"
+#include "../src/engine/effects.hpp"
+#include "../src/engine/reactive.hpp"
+
+// Reaches into Window's private state machine; declared a friend in window.hpp.
+struct WindowBench {
+    Window          window;
+    Window::Options options;
+
+    WindowBench() {
+        options.general   = { 600, 600, "bench" };
+        options.scene     = { "a", "", "fade" };
+
+        window.define("a", Window::Scene{});
+        window.define("b", Window::Scene{});
+        window.define("fade", Window::Transition{ .duration = 0.05f });
+        window.SceneState.current = "a";
+    }
+
+    // One frame of scene-state bookkeeping, as Window::init's loop does it.
+    void frame(float dt) {
+        window.tryStartTransition(options);
+        window.advanceTransition(dt);
+    }
+
+    bool idle() const {
+        return window.TransitionState.state == Window::Transition_State::State::Inactive
+            && !window.TransitionState.want_change;
+    }
+
+    const std::string& current() const { return window.SceneState.current; }
+
+    void addListeners(int n, int& sink) {
+        for (int i = 0; i < n; ++i) {
+            window.listen(Window::WindowEvents::Scale, [&sink](std::array<float, 2>, std::array<int, 2> size) { sink += size[0]; });
+            window.listen(Window::WindowEvents::Status, [&sink](Window::WindowStatus s) { sink += (int)s; });
+        }
+    }
+
+    // the same helpers init() and scaleCallbackExecution() dispatch through
+    void dispatchScale()  { window.emitScale({ 1.0f, 1.0f }, { 600, 600 }); }
+    void dispatchStatus() { window.emitStatus(Window::WindowStatus::Focus); }
+};
+
+
+// ---------- suites ----------
+static void dictSuite(bench::Runner& run) {
+    Dict<std::string, int> dict;
+    std::vector<std::string> hits, misses;
+    for (int i = 0; i < 64; ++i) {
+        hits.push_back("scene_" + std::to_string(i));
+        misses.push_back("missing_" + std::to_string(i));
+        dict[hits.back()] = i;
+    }
+
+    std::size_t i = 0;
+    run.run("dict.contains_hit", [&] { bench::keep(dict.contains(hits[i++ & 63])); });
+    run.run("dict.contains_miss", [&] { bench::keep(dict.contains(misses[i++ & 63])); });
+    run.run("dict.index_hit", [&] { bench::keep(dict[hits[i++ & 63]]); });
+}
+
+static void windowSuite(bench::Runner& run) {
+    const float dt = 1.0f / 60.0f;
+
+    WindowBench idle;
+    run.run("window.frame_idle", [&] { idle.frame(dt); });
+
+    // navigate + every frame until the transition has fully played out
+    WindowBench nav;
+    run.run("window.transition_cycle", [&] {
+        nav.window.navigate(nav.current() == "a" ? "b" : "a");
+        do { nav.frame(dt); } while (!nav.idle());
+    });
+
+    int sink = 0;
+    WindowBench listeners;
+    listeners.addListeners(8, sink);
+    run.run("window.dispatch_scale_x8", [&] { listeners.dispatchScale(); });
+    run.run("window.dispatch_status_x8", [&] { listeners.dispatchStatus(); });
+    bench::keep(sink);
+}
+
+static void effectsSuite(bench::Runner& run) {
+    Effects steady;
+    Effects::Particle p;
+    p.position = { 300.0f, 300.0f };
+    p.lifetime = 1e9f; // never expires, so the pool stays full
+    steady.burst(p, 100000, 50.0f);
+    run.run("effects.update_100k", [&] { steady.update(1e-6f); });
+
+    Effects churn;
+    Effects::Particle spark;
+    spark.lifetime = 0.5f;
+    run.run("effects.burst_1k", [&] {
+        churn.clear();
+        churn.burst(spark, 1000, 80.0f);
+    });
+
+    Effects texts;
+    for (int i = 0; i < 256; ++i) texts.number({ .position = { (float)(i % 16) * 40.0f, (float)(i / 16) * 40.0f }, .value = 1.0 });
+    int k = 0;
+    run.run("effects.number_merge", [&] {
+        texts.number({ .position = { (float)(k % 16) * 40.0f, (float)(k / 16 % 16) * 40.0f }, .value = 1.0 });
+        ++k;
+    });
+}
+
+static void reactiveSuite(bench::Runner& run) {
+    Reactive plain;
+    const auto v = plain.value(0.0);
+    double x = 0.0;
+    run.run("reactive.set_unwatched", [&] { plain.set(v, x += 1.0); });
+
+    // 1000 repeating thresholds; each flush crosses at most one of them
+    Reactive graph;
+    const auto gold = graph.value(0.0);
+    int fired = 0;
+    for (int i = 0; i < 1000; ++i) graph.when(gold, i * 1000.0, [&fired](bool) { ++fired; }, false);
+
+    bool up = false;
+    run.run("reactive.flush_cross_1_of_1k", [&] {
+        graph.set(gold, (up = !up) ? 500500.0 : 499500.0);
+        graph.flush();
+    });
+    double y = 500100.0;
+    run.run("reactive.flush_cross_0_of_1k", [&] {
+        graph.set(gold, (y = y > 500800.0 ? 500100.0 : y + 1.0));
+        graph.flush();
+    });
+
+    // derived chain depth 8, read back after every input change
+    Reactive chain;
+    const auto base = chain.value(1.0);
+    auto top = base;
+    for (int i = 0; i < 8; ++i) top = chain.derive({ top }, [](const std::vector<double>& in) { return in[0] * 1.01; });
+    double z = 1.0;
+    run.run("reactive.derived_chain_8", [&] {
+        chain.set(base, z += 1.0);
+        bench::keep(chain.get(top));
+    });
+    bench::keep(fired);
+}
+
+
+// ---------- baseline comparison ----------
+struct Baseline_Entry {
+    std::string name;
+    double p50 = 0.0;
+};
+
+static std::vector<Baseline_Entry> loadBaseline(const std::string& path) {
+    std::vector<Baseline_Entry> out;
+    std::ifstream in(path);
+    if (!in) {
+        std::cerr << "cannot read baseline " << path << std::endl;
+        std::exit(2);
+    }
+
+    std::string line;
+    while (std::getline(in, line)) {
+        const auto n = line.find("\"name\":\"");
+        const auto p = line.find("\"p50\":");
+        if (n == std::string::npos || p == std::string::npos) continue;
+        const auto start = n + 8;
+        out.push_back({ line.substr(start, line.find('"', start) - start),
+                        std::strtod(line.c_str() + p + 6, nullptr) });
+    }
+    return out;
+}
+
+// Every baseline entry selected by `filter` (same substring match as the
+// runner) must be matched by a result: a renamed benchmark or a suite that
+// stopped running counts as a failure. Entries the filter excludes are skipped.
+static int compare(const std::vector<bench::Result>& results, const std::vector<Baseline_Entry>& base,
+                   const std::string& filter, double tolerance) {
+    int regressions = 0, missing = 0, selected = 0;
+
+    std::fprintf(stderr, "\n%-36s %12s %12s %9s\n", "benchmark", "base p50", "p50", "delta");
+    for (const auto& old : base) {
+        if (!filter.empty() && old.name.find(filter) == std::string::npos) continue;
+        ++selected;
+
+        const bench::Result* match = nullptr;
+        for (const auto& r : results) {
+            if (r.name == old.name) { match = &r; break; }
+        }
+        if (!match) {
+            ++missing;
+            std::fprintf(stderr, "%-36s %12.2f %12s %9s  MISSING\n", old.name.c_str(), old.p50, "-", "-");
+            continue;
+        }
+        if (old.p50 <= 0.0) {
+            std::fprintf(stderr, "%-36s %12.2f %12.2f %9s  (no usable baseline)\n", old.name.c_str(), old.p50, match->p50, "-");
+            continue;
+        }
+
+        const double delta = (match->p50 - old.p50) / old.p50 * 100.0;
+        const bool   worse = delta > tolerance;
+        regressions += worse ? 1 : 0;
+        std::fprintf(stderr, "%-36s %12.2f %12.2f %+8.1f%%%s\n",
+                     old.name.c_str(), old.p50, match->p50, delta, worse ? "  REGRESSION" : "");
+    }
+
+    if (selected == 0) {
+        std::cerr << "baseline has no benchmark entries" << (filter.empty() ? "" : " matching --filter " + filter) << std::endl;
+        return 1;
+    }
+    if (missing > 0) std::fprintf(stderr, "%d baseline benchmark(s) missing from this run\n", missing);
+    return regressions > 0 || missing > 0 ? 1 : 0;
+}
+
+int main(int argc, char** argv) {
+    bench::Config config;
+    std::string out, baseline;
+    double tolerance = 10.0;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if      (arg == "--reps"      && hasValue) config.reps     = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--warmup"    && hasValue) config.warmup   = std::max(0, std::atoi(argv[++i]));
+        else if (arg == "--batch-us"  && hasValue) config.batch_us = std::atof(argv[++i]);
+        else if (arg == "--filter"    && hasValue) config.filter   = argv[++i];
+        else if (arg == "--out"       && hasValue) out             = argv[++i];
+        else if (arg == "--baseline"  && hasValue) baseline        = argv[++i];
+        else if (arg == "--tolerance" && hasValue) tolerance       = std::atof(argv[++i]);
+        else {
+            std::cerr << "usage: " << argv[0]
+                      << " [--reps N] [--warmup N] [--batch-us US] [--filter TEXT]"
+                         " [--out FILE] [--baseline FILE] [--tolerance PCT]" << std::endl;
+            return 2;
+        }
+    }
+
+    // read before running so --out may overwrite the same file
+    const auto base = baseline.empty() ? std::vector<Baseline_Entry>{} : loadBaseline(baseline);
+
+    bench::Runner runner(config);
+    dictSuite(runner);
+    windowSuite(runner);
+    effectsSuite(runner);
+    reactiveSuite(runner);
+
+    std::ofstream file;
+    if (!out.empty()) file.open(out);
+    std::ostream& sink = out.empty() ? std::cout : file;
+    for (const auto& r : runner.results()) sink << bench::Runner::json(r) << "\n";
+
+    return baseline.empty() ? 0 : compare(runner.results(), base, config.filter, tolerance);
+}
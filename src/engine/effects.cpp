@@ -0,0 +1,333 @@
+// effects.cpp
+#include "effects.hpp"
+#include <rlgl.h>
+#include <algorithm>      // std::min, std::max
+#include <cmath>          // std::fabs, std::floor, std::cos, std::sin
+#include <cstdio>         // std::snprintf
+#include <stdexcept>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using std::size_t;
+using std::string;
+
+
+// ---------- construction / pools ----------
+Effects::Effects() : Effects(Options{}) {}
+
+Effects::Effects(Options opts) : options(std::move(opts)) {
+    pools.emplace_back();
+    reserve(pools.back(), options.pool_capacity);
+    poolNames[""] = 0;
+
+    texts.capacity = options.text_budget;
+    texts.x.resize(texts.capacity);
+    texts.y.resize(texts.capacity);
+    texts.vx.assign(texts.capacity, 0.0f); // numbers only rise; kept for the shared kernel
+    texts.vy.resize(texts.capacity);
+    texts.life.resize(texts.capacity);
+    texts.inv_life.resize(texts.capacity);
+    texts.alpha.resize(texts.capacity);
+    texts.value.resize(texts.capacity);
+    texts.color.resize(texts.capacity);
+    texts.label.resize(texts.capacity);
+
+    particleBudget = options.particle_budget;
+    textBudget     = options.text_budget;
+}
+
+size_t Effects::define(std::string name, Texture2D texture, size_t capacity) {
+    if (poolNames.contains(name)) {
+        Particle_Pool& existing = pools[poolNames[name]];
+        existing.texture = texture;
+        return poolNames[name];
+    }
+
+    pools.emplace_back();
+    pools.back().texture = texture;
+    reserve(pools.back(), capacity > 0 ? capacity : options.pool_capacity);
+    poolNames[name] = pools.size() - 1;
+    return pools.size() - 1;
+}
+
+size_t Effects::pool(const std::string& name) {
+    if (!poolNames.contains(name))
+        throw std::runtime_error("Effect pool " + name + " was not defined.");
+    return poolNames[name];
+}
+
+void Effects::budget(size_t particles, size_t textLimit) {
+    size_t capacity = 0;
+    for (const auto& p : pools) capacity += p.capacity;
+
+    particleBudget = std::min(particles, capacity);
+    textBudget     = std::min(textLimit, texts.capacity);
+}
+
+// ---------- spawning ----------
+bool Effects::spawn(const Particle& particle, size_t index) {
+    if (index >= pools.size())
+        throw std::runtime_error("Effect pool " + std::to_string(index) + " was not defined.");
+    Particle_Pool& p = pools[index];
+
+    // Over budget: drop the newcomer; live effects are never cut short.
+    if (p.count >= p.capacity || liveParticles >= particleBudget) {
+        ++EffectsStats.dropped_particles;
+        return false;
+    }
+
+    const size_t i = p.count++;
+    const float lifetime = std::max(0.0001f, particle.lifetime);
+    p.x[i]        = particle.position.x;
+    p.y[i]        = particle.position.y;
+    p.vx[i]       = particle.velocity.x;
+    p.vy[i]       = particle.velocity.y;
+    p.life[i]     = lifetime;
+    p.inv_life[i] = 1.0f / lifetime;
+    p.alpha[i]    = 1.0f;
+    p.size[i]     = particle.size;
+    p.color[i]    = particle.color;
+    ++liveParticles;
+    return true;
+}
+
+void Effects::burst(Particle base, int count, float speed, size_t index) {
+    const Vector2 drift = base.velocity;
+    for (int n = 0; n < count; ++n) {
+        const float angle = random01() * 6.2831853f;
+        const float mag   = speed * (0.25f + 0.75f * random01());
+        base.velocity = { drift.x + std::cos(angle) * mag, drift.y + std::sin(angle) * mag };
+        if (!spawn(base, index)) {
+            // budget hit; the rest would drop too
+            EffectsStats.dropped_particles += (size_t)(count - n - 1);
+            break;
+        }
+    }
+}
+
+void Effects::number(const FloatingText& text) {
+    if (texts.count >= textBudget) {
+        // Merge into the closest live number so the total still reads correctly.
+        const float r2 = options.merge_radius * options.merge_radius;
+        size_t best = texts.count;
+        float bestD2 = r2;
+        for (size_t i = 0; i < texts.count; ++i) {
+            const float dx = texts.x[i] - text.position.x;
+            const float dy = texts.y[i] - text.position.y;
+            const float d2 = dx * dx + dy * dy;
+            if (d2 <= bestD2) { bestD2 = d2; best = i; }
+        }
+        if (best == texts.count) {
+            ++EffectsStats.dropped_texts;
+            return;
+        }
+
+        const float lifetime = std::max(0.0001f, text.lifetime);
+        texts.value[best] += text.value;
+        texts.life[best]     = std::max(texts.life[best], lifetime);
+        texts.inv_life[best] = 1.0f / texts.life[best];
+        texts.alpha[best]    = 1.0f;
+        relabel(best);
+        ++EffectsStats.merged_texts;
+        return;
+    }
+
+    const size_t i = texts.count++;
+    const float lifetime = std::max(0.0001f, text.lifetime);
+    texts.x[i]        = text.position.x;
+    texts.y[i]        = text.position.y;
+    texts.vy[i]       = -text.rise;
+    texts.life[i]     = lifetime;
+    texts.inv_life[i] = 1.0f / lifetime;
+    texts.alpha[i]    = 1.0f;
+    texts.value[i]    = text.value;
+    texts.color[i]    = text.color;
+    relabel(i);
+}
+
+// ---------- per-frame ----------
+void Effects::update(float dt) {
+    liveParticles = 0;
+    for (auto& p : pools) {
+        integrate(p.x.data(), p.y.data(), p.vx.data(), p.vy.data(),
+                  p.life.data(), p.inv_life.data(), p.alpha.data(),
+                  p.count, dt, options.gravity);
+        compact(p);
+        liveParticles += p.count;
+    }
+
+    integrate(texts.x.data(), texts.y.data(), texts.vx.data(), texts.vy.data(),
+              texts.life.data(), texts.inv_life.data(), texts.alpha.data(),
+              texts.count, dt, 0.0f);
+    compact(texts);
+
+    EffectsStats.live_particles = liveParticles;
+    EffectsStats.live_texts     = texts.count;
+}
+
+void Effects::draw() {
+    EffectsStats.draw_calls = 0;
+
+    // One quad pass per pool texture. rlgl's batch buffer holds far fewer quads
+    // than a full pool (8192 by default), so a pass is split into several GPU
+    // draws whenever rlCheckRenderBatchLimit() flushes; those are counted too.
+    for (auto& p : pools) {
+        if (p.count == 0) continue;
+        const unsigned int tex = p.texture.id != 0 ? p.texture.id : rlGetTextureIdDefault();
+
+        rlSetTexture(tex);
+        rlBegin(RL_QUADS);
+        rlNormal3f(0.0f, 0.0f, 1.0f);
+        for (size_t i = 0; i < p.count; ++i) {
+            if (rlCheckRenderBatchLimit(4)) ++EffectsStats.draw_calls;
+
+            const float h  = p.size[i] * 0.5f;
+            const float x0 = p.x[i] - h, x1 = p.x[i] + h;
+            const float y0 = p.y[i] - h, y1 = p.y[i] + h;
+            const Color c  = p.color[i];
+            rlColor4ub(c.r, c.g, c.b, (unsigned char)(c.a * p.alpha[i]));
+
+            rlTexCoord2f(0.0f, 0.0f); rlVertex2f(x0, y0);
+            rlTexCoord2f(0.0f, 1.0f); rlVertex2f(x0, y1);
+            rlTexCoord2f(1.0f, 1.0f); rlVertex2f(x1, y1);
+            rlTexCoord2f(1.0f, 0.0f); rlVertex2f(x1, y0);
+        }
+        rlEnd();
+        rlSetTexture(0);
+        ++EffectsStats.draw_calls; // the pass's final partial batch
+    }
+
+    for (size_t i = 0; i < texts.count; ++i) {
+        DrawText(texts.label[i].data(), (int)texts.x[i], (int)texts.y[i],
+                 options.font_size, Fade(texts.color[i], texts.alpha[i]));
+    }
+}
+
+void Effects::clear() {
+    for (auto& p : pools) p.count = 0;
+    texts.count   = 0;
+    liveParticles = 0;
+    EffectsStats.live_particles = 0;
+    EffectsStats.live_texts     = 0;
+}
+
+std::string Effects::formatShort(double value) {
+    static const char* suffixes[] = { "", "K", "M", "B", "T", "Qa", "Qi", "Sx", "Sp", "Oc", "No" };
+    const size_t count = sizeof(suffixes) / sizeof(suffixes[0]);
+
+    char buf[32];
+    double mag = std::fabs(value);
+    size_t tier = 0;
+    while (mag >= 1000.0 && tier + 1 < count) { mag /= 1000.0; ++tier; }
+    // 999.96 would print as "1000.0"; it rounds into the next tier instead
+    if (mag >= 999.95 && tier + 1 < count) { mag /= 1000.0; ++tier; }
+
+    if (mag >= 999.95) {
+        std::snprintf(buf, sizeof(buf), "%.2e", std::fabs(value));
+    } else if (tier == 0 && mag == std::floor(mag)) {
+        std::snprintf(buf, sizeof(buf), "%.0f", mag);
+    } else {
+        std::snprintf(buf, sizeof(buf), "%.1f%s", mag, suffixes[tier]);
+    }
+    return (value < 0.0 ? "-" : "") + std::string(buf);
+}
+
+
+// ---------- internals ----------
+void Effects::reserve(Particle_Pool& p, size_t capacity) {
+    p.capacity = capacity;
+    p.x.resize(capacity);
+    p.y.resize(capacity);
+    p.vx.resize(capacity);
+    p.vy.resize(capacity);
+    p.life.resize(capacity);
+    p.inv_life.resize(capacity);
+    p.alpha.resize(capacity);
+    p.size.resize(capacity);
+    p.color.resize(capacity);
+}
+
+// Swap-remove expired entries so the live range stays packed.
+void Effects::compact(Particle_Pool& p) {
+    size_t i = 0;
+    while (i < p.count) {
+        if (p.life[i] > 0.0f) { ++i; continue; }
+        const size_t last = --p.count;
+        p.x[i]        = p.x[last];
+        p.y[i]        = p.y[last];
+        p.vx[i]       = p.vx[last];
+        p.vy[i]       = p.vy[last];
+        p.life[i]     = p.life[last];
+        p.inv_life[i] = p.inv_life[last];
+        p.alpha[i]    = p.alpha[last];
+        p.size[i]     = p.size[last];
+        p.color[i]    = p.color[last];
+    }
+}
+
+void Effects::compact(Text_Pool& t) {
+    size_t i = 0;
+    while (i < t.count) {
+        if (t.life[i] > 0.0f) { ++i; continue; }
+        const size_t last = --t.count;
+        t.x[i]        = t.x[last];
+        t.y[i]        = t.y[last];
+        t.vy[i]       = t.vy[last];
+        t.life[i]     = t.life[last];
+        t.inv_life[i] = t.inv_life[last];
+        t.alpha[i]    = t.alpha[last];
+        t.value[i]    = t.value[last];
+        t.color[i]    = t.color[last];
+        t.label[i]    = t.label[last];
+    }
+}
+
+void Effects::relabel(size_t i) {
+    const string s = (texts.value[i] >= 0.0 ? "+" : "") + formatShort(texts.value[i]);
+    std::snprintf(texts.label[i].data(), texts.label[i].size(), "%s", s.c_str());
+}
+
+// xorshift32; cheap enough to call per particle in a burst
+float Effects::random01() {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return (float)(rngState >> 8) * (1.0f / 16777216.0f);
+}
+
+// Position/velocity/lifetime/alpha step over packed arrays, four lanes at a time.
+void Effects::integrate(float* x, float* y, const float* vx, float* vy,
+                        float* life, const float* inv_life, float* alpha,
+                        size_t n, float dt, float gravity) {
+    size_t i = 0;
+    const float dv = gravity * dt;
+
+#if defined(__SSE2__)
+    const __m128 vdt  = _mm_set1_ps(dt);
+    const __m128 vdv  = _mm_set1_ps(dv);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one  = _mm_set1_ps(1.0f);
+    for (; i + 4 <= n; i += 4) {
+        const __m128 nvy = _mm_add_ps(_mm_loadu_ps(vy + i), vdv);
+        _mm_storeu_ps(vy + i, nvy);
+        _mm_storeu_ps(x + i, _mm_add_ps(_mm_loadu_ps(x + i), _mm_mul_ps(_mm_loadu_ps(vx + i), vdt)));
+        _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(nvy, vdt)));
+
+        const __m128 l = _mm_sub_ps(_mm_loadu_ps(life + i), vdt);
+        _mm_storeu_ps(life + i, l);
+        const __m128 a = _mm_mul_ps(l, _mm_loadu_ps(inv_life + i));
+        _mm_storeu_ps(alpha + i, _mm_min_ps(_mm_max_ps(a, zero), one));
+    }
+#endif
+
+    // scalar tail (or the whole range without SSE2)
+    for (; i < n; ++i) {
+        vy[i]   += dv;
+        x[i]    += vx[i] * dt;
+        y[i]    += vy[i] * dt;
+        life[i] -= dt;
+        alpha[i] = std::clamp(life[i] * inv_life[i], 0.0f, 1.0f);
+    }
+}
@@ -0,0 +1,111 @@
+// effects.hpp
+#pragma once
+#include <raylib.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "map.hpp"
+
+// Pooled short-lived visuals: click particles and "+1.2K" floating numbers.
+// Every pool is a fixed-capacity structure-of-arrays; live entries are kept
+// packed in [0, count) so update and draw walk contiguous memory.
+class Effects {
+    public:
+        struct Options {
+            std::size_t particle_budget = 100000; // live particles across all pools
+            std::size_t pool_capacity   = 100000; // default slots per particle pool
+            std::size_t text_budget     = 256;    // live floating numbers
+            float       gravity         = 0.0f;   // px/s^2 applied to particles
+            float       merge_radius    = 48.0f;  // over budget, numbers this close merge
+            int         font_size       = 20;
+        };
+
+        struct Particle {
+            Vector2 position{};
+            Vector2 velocity{};
+            float   lifetime = 1.0f; // seconds
+            float   size     = 4.0f; // px, square
+            Color   color    = WHITE;
+        };
+
+        struct FloatingText {
+            Vector2 position{};
+            double  value    = 0.0;
+            float   rise     = 40.0f; // px/s upward
+            float   lifetime = 1.0f;  // seconds
+            Color   color    = RAYWHITE;
+        };
+
+        struct Effects_Stats {
+            std::size_t live_particles    = 0;
+            std::size_t live_texts        = 0;
+            std::size_t dropped_particles = 0; // spawns rejected by the budget
+            std::size_t merged_texts      = 0; // numbers folded into a nearby one
+            std::size_t dropped_texts     = 0; // numbers with nothing to merge into
+            std::size_t draw_calls        = 0; // GPU draws from last draw(): per pool, 1 + buffer flushes
+        } EffectsStats;
+
+        Effects();
+        explicit Effects(Options options);
+
+        // Pool 0 is the untextured default pool; define() adds one pool per texture.
+        std::size_t define(std::string name, Texture2D texture, std::size_t capacity = 0);
+        std::size_t pool(const std::string& name);
+
+        //* Spawning (an undefined pool index throws, like pool())
+        bool spawn(const Particle& particle, std::size_t pool = 0);
+        void burst(Particle base, int count, float speed, std::size_t pool = 0);
+        void number(const FloatingText& text);
+
+        // Lower (or restore) the live limits at runtime; clamped to the capacities.
+        void budget(std::size_t particles, std::size_t texts);
+
+        void update(float dt);
+        void draw();
+        void clear();
+
+        // 1234.5 -> "1.2K", 2.5e9 -> "2.5B"
+        static std::string formatShort(double value);
+
+    private:
+        struct Particle_Pool {
+            Texture2D   texture{};   // id 0 -> rlgl default white texture
+            std::size_t capacity = 0;
+            std::size_t count    = 0;
+            std::vector<float> x, y, vx, vy, life, inv_life, alpha, size;
+            std::vector<Color> color;
+        };
+
+        struct Text_Pool {
+            std::size_t capacity = 0;
+            std::size_t count    = 0;
+            std::vector<float>  x, y, vx, vy, life, inv_life, alpha;
+            std::vector<double> value;
+            std::vector<Color>  color;
+            std::vector<std::array<char, 24>> label;
+        };
+
+        Options options;
+        std::size_t particleBudget = 0;
+        std::size_t textBudget     = 0;
+        std::size_t liveParticles  = 0;
+        std::uint32_t rngState     = 0x9E3779B9u;
+
+        std::vector<Particle_Pool> pools;
+        Dict<std::string, std::size_t> poolNames;
+        Text_Pool texts;
+
+        // --- internals ---
+        void  reserve(Particle_Pool& p, std::size_t capacity);
+        void  compact(Particle_Pool& p);
+        void  compact(Text_Pool& t);
+        void  relabel(std::size_t i);
+        float random01();
+
+        static void integrate(float* x, float* y, const float* vx, float* vy,
+                              float* life, const float* inv_life, float* alpha,
+                              std::size_t n, float dt, float gravity);
+};
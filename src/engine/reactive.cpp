@@ -0,0 +1,202 @@
+// reactive.cpp
+#include "reactive.hpp"
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+using std::function;
+using std::vector;
+
+
+// ---------- definition ----------
+Reactive::Id Reactive::value(double initial) {
+    Node n;
+    n.value = initial;
+    n.seen  = initial;
+    nodes.push_back(std::move(n));
+    return nodes.size() - 1;
+}
+
+Reactive::Id Reactive::derive(vector<Id> inputs, function<double(const vector<double>&)> compute) {
+    // validate every input before wiring any edge, so a bad id leaves the graph untouched
+    for (Id in : inputs) node(in);
+
+    const Id id = nodes.size();
+    for (Id in : inputs) nodes[in].dependents.push_back(id);
+
+    Node n;
+    n.derived = true;
+    n.dirty   = true;           // first get() computes
+    n.args.resize(inputs.size());
+    n.inputs  = std::move(inputs);
+    n.compute = std::move(compute);
+    nodes.push_back(std::move(n));
+    return id;
+}
+
+// ---------- values ----------
+void Reactive::set(Id id, double v) {
+    Node& n = node(id);
+    if (n.derived) throw std::runtime_error("Reactive value " + std::to_string(id) + " is derived and cannot be set.");
+    if (n.value == v) return;
+
+    n.value = v;
+    if (n.watched()) enqueue(id);
+    for (Id dep : n.dependents) invalidate(dep);
+}
+
+void Reactive::add(Id id, double delta) {
+    set(id, node(id).value + delta);
+}
+
+double Reactive::get(Id id) {
+    Node& n = node(id);
+    if (!n.dirty) return n.value;
+
+    // inputs always have lower ids, so this recursion cannot cycle
+    for (std::size_t i = 0; i < n.inputs.size(); ++i) n.args[i] = get(n.inputs[i]);
+    n.value = n.compute(n.args);
+    n.dirty = false;
+    return n.value;
+}
+
+// ---------- observers ----------
+Reactive::Handle Reactive::when(Id id, double threshold, function<void(bool)> callback, bool once) {
+    if (node(id).queued) settle(id); // don't replay changes the new observer already sees
+    const double current = get(id);
+    const bool met = current >= threshold;
+    const Handle handle = nextHandle++;
+
+    if (met) callback(true);
+    if (met && once) return handle;
+
+    Node& n = node(id);
+    if (!n.watched()) n.seen = current;
+    n.conditions.emplace(threshold, Condition{
+        handle, std::make_shared<const function<void(bool)>>(std::move(callback)), once });
+    observers[handle] = id;
+    return handle;
+}
+
+Reactive::Handle Reactive::bind(Id id, function<void(double)> callback) {
+    if (node(id).queued) settle(id);
+    const double current = get(id);
+    const Handle handle = nextHandle++;
+    callback(current);
+
+    Node& n = node(id);
+    if (!n.watched()) n.seen = current;
+    n.bindings.push_back(Binding{ handle, std::make_shared<const function<void(double)>>(std::move(callback)) });
+    observers[handle] = id;
+    return handle;
+}
+
+void Reactive::unwhen(Handle handle) {
+    if (!observers.contains(handle)) return;
+    auto& conditions = nodes[observers[handle]].conditions;
+    for (auto it = conditions.begin(); it != conditions.end(); ++it) {
+        if (it->second.handle != handle) continue;
+        conditions.erase(it);
+        observers.erase(handle);
+        return;
+    }
+}
+
+void Reactive::unbind(Handle handle) {
+    if (!observers.contains(handle)) return;
+    auto& bindings = nodes[observers[handle]].bindings;
+    for (auto it = bindings.begin(); it != bindings.end(); ++it) {
+        if (it->handle != handle) continue;
+        bindings.erase(it);
+        observers.erase(handle);
+        return;
+    }
+}
+
+void Reactive::flush() {
+    // callbacks may set() more values; anything they queue is settled in this pass too
+    for (std::size_t i = 0; i < queue.size(); ++i) settle(queue[i]);
+    queue.clear();
+}
+
+
+// ---------- internals ----------
+Reactive::Node& Reactive::node(Id id) {
+    if (id >= nodes.size())
+        throw std::runtime_error("Reactive value " + std::to_string(id) + " was not defined.");
+    return nodes[id];
+}
+
+// Mark `id` and everything downstream dirty. A node that is already dirty has
+// dirty dependents too, so the walk stops there.
+void Reactive::invalidate(Id id) {
+    stack.clear();
+    stack.push_back(id);
+    while (!stack.empty()) {
+        const Id cur = stack.back();
+        stack.pop_back();
+
+        Node& n = nodes[cur];
+        if (n.dirty) continue;
+        n.dirty = true;
+        if (n.watched()) enqueue(cur);
+        for (Id dep : n.dependents) stack.push_back(dep);
+    }
+}
+
+void Reactive::enqueue(Id id) {
+    Node& n = nodes[id];
+    if (n.queued) return;
+    n.queued = true;
+    queue.push_back(id);
+}
+
+// Fire bindings and every condition whose threshold lies between the value at
+// the last flush and the value now.
+void Reactive::settle(Id id) {
+    const double now = get(id);
+    Node& n = nodes[id];
+    n.queued = false;
+
+    const double before = n.seen;
+    if (now == before) return;
+    n.seen = now;
+
+    // A callback may call when()/bind(), which can settle another value and
+    // reuse the scratch vectors; each call only touches entries past its base.
+    const std::size_t firedBase = fired.size();
+    const std::size_t boundBase = bound.size();
+
+    if (now > before) {
+        // thresholds in (before, now] became met
+        auto it  = n.conditions.upper_bound(before);
+        auto end = n.conditions.upper_bound(now);
+        while (it != end) {
+            fired.emplace_back(it->second.callback, true);
+            if (!it->second.once) { ++it; continue; }
+            observers.erase(it->second.handle);
+            it = n.conditions.erase(it);
+        }
+    } else {
+        // thresholds in (now, before] are no longer met
+        auto it  = n.conditions.upper_bound(now);
+        auto end = n.conditions.upper_bound(before);
+        for (; it != end; ++it) fired.emplace_back(it->second.callback, false);
+    }
+    for (const auto& b : n.bindings) bound.push_back(b.callback);
+
+    // `n` may dangle from here on: callbacks can define values and reallocate `nodes`
+    const std::size_t firedEnd = fired.size();
+    const std::size_t boundEnd = bound.size();
+    for (std::size_t i = firedBase; i < firedEnd; ++i) {
+        const Condition_Fn cb = fired[i].first;
+        (*cb)(fired[i].second);
+    }
+    for (std::size_t i = boundBase; i < boundEnd; ++i) {
+        const Binding_Fn cb = bound[i];
+        (*cb)(now);
+    }
+
+    fired.resize(firedBase);
+    bound.resize(boundBase);
+}
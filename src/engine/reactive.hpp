@@ -0,0 +1,98 @@
+// reactive.hpp
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "map.hpp"
+
+// Dependency-tracked numeric values for unlocks, achievements and UI labels.
+//
+// Sources are set by game code; derived values recompute lazily, only after
+// one of their inputs changed. Conditions and bindings are settled in flush()
+// (once per frame), which only visits values touched since the last flush and
+// only the thresholds that the change actually crossed.
+class Reactive {
+    public:
+        using Id     = std::size_t;
+        using Handle = std::size_t; // identifies one when()/bind() registration
+
+        Id value(double initial = 0.0);
+        Id derive(std::vector<Id> inputs, std::function<double(const std::vector<double>&)> compute);
+
+        void   set(Id id, double v);
+        void   add(Id id, double delta);
+        double get(Id id);
+
+        // callback(true) once the value reaches `threshold`, callback(false) when it
+        // falls back below. `once` conditions (unlocks, achievements) are dropped
+        // after first firing. Already-met conditions fire immediately.
+        Handle when(Id id, double threshold, std::function<void(bool)> callback, bool once = true);
+
+        // Called with the new value whenever it changed since the last flush.
+        Handle bind(Id id, std::function<void(double)> callback);
+
+        // Drop a registration, e.g. from a scene's onUnload. Unknown or already
+        // fired handles are ignored.
+        void unwhen(Handle handle);
+        void unbind(Handle handle);
+
+        void flush();
+
+        std::size_t pending() const { return queue.size(); }
+
+    private:
+        // Shared so settle() can hold a callback without copying the closure,
+        // and a callback may unwhen()/unbind() itself while it runs.
+        using Condition_Fn = std::shared_ptr<const std::function<void(bool)>>;
+        using Binding_Fn   = std::shared_ptr<const std::function<void(double)>>;
+
+        struct Condition {
+            Handle       handle = 0;
+            Condition_Fn callback;
+            bool         once = true;
+        };
+
+        struct Binding {
+            Handle     handle = 0;
+            Binding_Fn callback;
+        };
+
+        struct Node {
+            double value = 0.0;
+            double seen  = 0.0;   // value as of the last flush
+            bool   derived = false;
+            bool   dirty   = false;
+            bool   queued  = false;
+
+            std::vector<Id>     inputs;
+            std::vector<Id>     dependents;
+            std::vector<double> args;  // scratch for compute, sized to inputs
+            std::function<double(const std::vector<double>&)> compute;
+
+            std::multimap<double, Condition> conditions; // keyed by threshold
+            std::vector<Binding>             bindings;
+
+            bool watched() const { return !conditions.empty() || !bindings.empty(); }
+        };
+
+        std::vector<Node> nodes;
+        std::vector<Id>   queue;  // watched values touched since the last flush
+        std::vector<Id>   stack;  // scratch for invalidate()
+
+        // scratch for settle(); reused so flush() does not allocate once warm
+        std::vector<std::pair<Condition_Fn, bool>> fired;
+        std::vector<Binding_Fn>                    bound;
+
+        Dict<Handle, Id> observers;  // live registration -> observed value
+        Handle nextHandle = 1;
+
+        // --- internals ---
+        Node& node(Id id);
+        void  invalidate(Id id);
+        void  enqueue(Id id);
+        void  settle(Id id);
+};
@@ -88,7 +88,7 @@ void Window::init(Options options) {
     SetTraceLogLevel(LOG_ERROR);
     InitWindow(W, H, TITLE.c_str());
     SetTargetFPS(60);
-    for (auto &cb : gStatusListeners) cb(WindowStatus::Open);
+    emitStatus(WindowStatus::Open);
 
     // First onLoad for start scene
     if (!SceneState.current.empty() && scenes.contains(SceneState.current) && scenes[SceneState.current].onLoad) {
@@ -148,7 +148,7 @@ void Window::init(Options options) {
 
 
     if (canvas.id != 0) UnloadRenderTexture(canvas);
-    for (auto &cb : gStatusListeners) cb(WindowStatus::Close);
+    emitStatus(WindowStatus::Close);
     CloseWindow();
 }
 
@@ -188,11 +188,19 @@ void Window::scaleCallbackExecution(int& lastW, int& lastH, int baseW, int baseH
         // fire resize/scale listeners
         std::array<float,2> scale{ WindowData.scale_width, WindowData.scale_height };
         std::array<int,2>   size { curW, curH };
-        for (auto &cb : gScaleListeners) cb(scale, size);
+        emitScale(scale, size);
     }
 
 }
 
+void Window::emitScale(std::array<float,2> scale, std::array<int,2> size) {
+    for (auto &cb : gScaleListeners) cb(scale, size);
+}
+
+void Window::emitStatus(WindowStatus status) {
+    for (auto &cb : gStatusListeners) cb(status);
+}
+
 
 // ---------------------- helpers: selection / math ----------------------
 float Window::norm(float t, float dur) const {
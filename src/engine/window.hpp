@@ -84,6 +84,9 @@ class Window {
         void hide(std::string popup);
 
     private:
+        // bench/main.cpp drives the transition state machine and listeners without a window
+        friend struct WindowBench;
+
         std::vector<std::function<void(std::array<float,2>, std::array<int,2>)>> gScaleListeners;
         std::vector<std::function<void(Window::WindowStatus)>> gStatusListeners;
         Dict<std::string, Scene> scenes;
@@ -126,6 +129,8 @@ class Window {
         void ensureCanvas();
 
         void scaleCallbackExecution(int& lastW, int& lastH, int baseW, int baseH);
+        void emitScale(std::array<float,2> scale, std::array<int,2> size);
+        void emitStatus(WindowStatus status);
 
         // --- NEW: transition helpers ---
         void         tryStartTransition(const Options& opts);
@@ -3,16 +3,20 @@
 #include <iostream>
 
 #include "engine/window.hpp"
+#include "engine/effects.hpp"
 
 #include "scenes/title.cpp"
+#include "scenes/stress.cpp"
 
 int main() {
     Window window;
+    Effects effects;
 
 
     // Regular scenes
     window.define("menu", titleScene(window));
     window.define("game", gameScene(window));
+    window.define("stress", stressScene(window, effects));
     window.define( "blinds", transition());
 
     window.listen(Window::WindowEvents::Scale, [&window](std::array<float, 2>, std::array<int, 2> size){
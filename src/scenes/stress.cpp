@@ -0,0 +1,73 @@
+#include "../engine/window.hpp"
+#include "../engine/effects.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+
+// Keeps `target` particles alive and reports how long update/draw take.
+inline Window::Scene stressScene(Window& sm, Effects& fx, std::size_t target = 100000) {
+    struct Timing_Data {
+        double update_ms = 0.0;
+        double draw_ms   = 0.0;
+        double frame_ms  = 0.0;
+    };
+    auto timing = std::make_shared<Timing_Data>();
+
+    // exponential moving average so the readout is legible
+    auto smooth = [](double& avg, double sample) { avg += (sample - avg) * 0.05; };
+
+    return Window::Scene{
+        .onLoad = [&fx](){ fx.clear(); },
+        .onUnload = [&fx](){ fx.clear(); },
+        .onUpdate = [&sm, &fx, target, timing, smooth](float dt){
+            if (IsKeyPressed(KEY_SPACE)) sm.navigate("menu");
+
+            // Top up toward the target, ramping so the first frames stay responsive.
+            const std::size_t live = fx.EffectsStats.live_particles;
+            int missing = (int)std::min<std::size_t>(target > live ? target - live : 0, 20000);
+            const float W = (float)GetScreenWidth();
+            const float H = (float)GetScreenHeight();
+            bool gold = false;
+            while (missing > 0) {
+                const int n = std::min(missing, 500);
+                Effects::Particle p;
+                p.position = { W * (float)GetRandomValue(0, 1000) / 1000.0f,
+                               H * (float)GetRandomValue(0, 1000) / 1000.0f };
+                p.lifetime = 1.5f + (float)GetRandomValue(0, 100) / 100.0f;
+                p.size     = 2.0f;
+                p.color    = (gold = !gold) ? GOLD : SKYBLUE;
+                fx.burst(p, n, 60.0f);
+                missing -= n;
+            }
+
+            if (IsMouseButtonDown(MOUSE_BUTTON_LEFT)) {
+                const Vector2 m = GetMousePosition();
+                for (int i = 0; i < 32; ++i) fx.number({ .position = m, .value = 1234.5, .color = YELLOW });
+            }
+
+            const double t0 = GetTime();
+            fx.update(dt);
+            smooth(timing->update_ms, (GetTime() - t0) * 1000.0);
+            smooth(timing->frame_ms, dt * 1000.0);
+        },
+        .onDraw = [&sm, &fx, timing, smooth](){
+            ClearBackground(BLACK);
+
+            const double t0 = GetTime();
+            fx.draw();
+            smooth(timing->draw_ms, (GetTime() - t0) * 1000.0);
+
+            char line[160];
+            const int font = (int)std::clamp(sm.WindowData.scale_width * 18.0f, 10.0f, 24.0f);
+            std::snprintf(line, sizeof(line), "particles %zu  texts %zu  draws %zu  dropped %zu  merged %zu",
+                          fx.EffectsStats.live_particles, fx.EffectsStats.live_texts,
+                          fx.EffectsStats.draw_calls, fx.EffectsStats.dropped_particles,
+                          fx.EffectsStats.merged_texts);
+            DrawText(line, 10, 10, font, RAYWHITE);
+            std::snprintf(line, sizeof(line), "update %.2f ms  draw %.2f ms  frame %.2f ms (%d fps)",
+                          timing->update_ms, timing->draw_ms, timing->frame_ms, GetFPS());
+            DrawText(line, 10, 10 + font + 4, font, RAYWHITE);
+            DrawText("hold LMB for floating numbers, SPACE for menu", 10, 10 + 2 * (font + 4), font, GRAY);
+        }
+    };
+}
@@ -8,6 +8,7 @@ inline Window::Scene titleScene(Window& sm) {
         .onUnload = [](){},
         .onUpdate = [&](float){ 
             if (IsKeyPressed(KEY_SPACE)) sm.navigate("game"); 
+            if (IsKeyPressed(KEY_S)) sm.navigate("stress");
         },
         .onDraw = [&](){
             ClearBackground(DARKBLUE);
@@ -15,6 +16,7 @@ inline Window::Scene titleScene(Window& sm) {
             float font_width = std::clamp(sm.WindowData.scale_width * 60.0f, 0.0f, 60.0f);
             float font_height = std::clamp(sm.WindowData.scale_height * 60.0f, 0.0f, 60.0f);
             DrawText("MENU — press SPACE", font_width, font_height, font, RAYWHITE);
+            DrawText("S — particle stress test", font_width, font_height + font * 1.5f, font * 0.75f, RAYWHITE);
         }
     };
 }